@@ -2,10 +2,13 @@
 #include <stdlib.h>
 #include <string.h>
 #include <stdbool.h>
+#include <stdint.h>
+#include <math.h>
 
 #define MAX_NAME_LENGTH 50
 #define MAX_USERS 1000
 #define MAX_CONNECTIONS 50
+#define MSBFS_BATCH_SIZE 64 // Sources per multi-source BFS batch (one bit each)
 #define RED 0
 #define BLACK 1
 
@@ -13,12 +16,19 @@
 typedef struct User {
     int id;
     char name[MAX_NAME_LENGTH];
-    int connections[MAX_CONNECTIONS];
+    int *connections; // MAX_CONNECTIONS slots sorted by ID, NULL while compact
     int connection_count;
     float influence_score;
     int community_id;
+    int coreness; // k-core number, -1 until computed
 } User;
 
+// Metric used as the base of influence scores
+typedef enum {
+    INFLUENCE_DEGREE,
+    INFLUENCE_CORENESS
+} InfluenceMetric;
+
 // Red-Black Tree Node
 typedef struct RBNode {
     int user_id;
@@ -26,13 +36,30 @@ typedef struct RBNode {
     struct RBNode *left, *right, *parent;
 } RBNode;
 
+// Compact adjacency (sorted neighbor lists, gap + varint encoded)
+typedef struct CompressedGraph {
+    int *offsets; // user_count + 1 entries, byte offset of each user's list in data
+    unsigned char *data;
+    int data_size;
+} CompressedGraph;
+
 // Graph structure
 typedef struct Graph {
     User users[MAX_USERS];
     int user_count;
     RBNode *rb_root;
+    CompressedGraph *compressed; // Neighbor storage while compact, NULL otherwise
+    bool coreness_valid; // False once the graph changes after a k-core run
 } Graph;
 
+// Cursor over one user's neighbors in either storage form
+typedef struct {
+    const int *raw;          // Raw connection array, NULL when compact
+    const unsigned char *p;  // Position in compact data
+    int remaining;
+    unsigned int previous;   // Last decoded ID (gaps are relative to it)
+} NeighborIterator;
+
 // Visited tracking structures
 typedef struct {
     bool visited[MAX_USERS];
@@ -50,6 +77,19 @@ typedef struct {
     int front, rear;
 } Queue;
 
+// Sparse accumulator for friend recommendations (reused between queries)
+typedef struct {
+    float score[MAX_USERS];
+    int touched[MAX_USERS];
+    int touched_count;
+} RecommendationScratch;
+
+// Single recommendation entry
+typedef struct {
+    int user_id;
+    float score;
+} Recommendation;
+
 // Stack functions
 void initStack(Stack *s) {
     s->top = -1;
@@ -273,6 +313,199 @@ int findUserByName(Graph *graph, char *name) {
 void initGraph(Graph *graph) {
     graph->user_count = 0;
     graph->rb_root = NULL;
+    graph->compressed = NULL;
+    graph->coreness_valid = false;
+}
+
+// Compact adjacency functions
+void freeCompressedGraph(Graph *graph) {
+    if (graph->compressed != NULL) {
+        free(graph->compressed->offsets);
+        free(graph->compressed->data);
+        free(graph->compressed);
+        graph->compressed = NULL;
+    }
+}
+
+// Write value as a varint (7 bits per byte, high bit marks continuation)
+int encodeVarint(unsigned char *out, unsigned int value) {
+    int length = 0;
+    
+    while (value >= 0x80) {
+        out[length++] = (unsigned char)(value | 0x80);
+        value >>= 7;
+    }
+    out[length++] = (unsigned char)value;
+    
+    return length;
+}
+
+// Start iterating a user's neighbors (ascending ID order)
+void initNeighborIterator(Graph *graph, int user_id, NeighborIterator *it) {
+    it->remaining = graph->users[user_id].connection_count;
+    it->previous = 0;
+    
+    if (graph->compressed != NULL) {
+        it->raw = NULL;
+        it->p = graph->compressed->data + graph->compressed->offsets[user_id];
+    } else {
+        it->raw = graph->users[user_id].connections;
+        it->p = NULL;
+    }
+}
+
+// Get the next neighbor, decoding compact gaps in place; returns false when done
+bool nextNeighbor(NeighborIterator *it, int *neighbor) {
+    if (it->remaining == 0) {
+        return false;
+    }
+    it->remaining--;
+    
+    if (it->raw != NULL) {
+        *neighbor = *it->raw++;
+        return true;
+    }
+    
+    // Single-byte gaps are the common case
+    unsigned int gap = *it->p++;
+    if (gap & 0x80) {
+        int shift = 7;
+        gap &= 0x7F;
+        
+        while (*it->p & 0x80) {
+            gap |= (unsigned int)(*it->p++ & 0x7F) << shift;
+            shift += 7;
+        }
+        gap |= (unsigned int)(*it->p++) << shift;
+    }
+    
+    it->previous += gap;
+    *neighbor = (int)it->previous;
+    return true;
+}
+
+// Compact adjacency storage - encode every neighbor list as varint gaps and
+// release the raw connection arrays. The next added user or friendship
+// expands the graph back to raw arrays.
+bool compactAdjacency(Graph *graph) {
+    if (graph->compressed != NULL) {
+        printf("Adjacency is already compact.\n");
+        return true;
+    }
+    
+    int edge_count = 0;
+    for (int i = 0; i < graph->user_count; i++) {
+        edge_count += graph->users[i].connection_count;
+    }
+    
+    CompressedGraph *cg = (CompressedGraph *)malloc(sizeof(CompressedGraph));
+    if (cg == NULL) {
+        printf("Error: Out of memory.\n");
+        return false;
+    }
+    
+    cg->offsets = (int *)malloc((graph->user_count + 1) * sizeof(int));
+    // Worst case is 5 bytes per varint
+    cg->data = (unsigned char *)malloc(edge_count * 5 + 1);
+    
+    if (cg->offsets == NULL || cg->data == NULL) {
+        printf("Error: Out of memory.\n");
+        free(cg->offsets);
+        free(cg->data);
+        free(cg);
+        return false;
+    }
+    
+    // Raw lists are kept sorted, so gaps are never negative
+    int size = 0;
+    for (int i = 0; i < graph->user_count; i++) {
+        cg->offsets[i] = size;
+        
+        int previous = 0;
+        for (int j = 0; j < graph->users[i].connection_count; j++) {
+            int neighbor = graph->users[i].connections[j];
+            size += encodeVarint(cg->data + size, (unsigned int)(neighbor - previous));
+            previous = neighbor;
+        }
+    }
+    cg->offsets[graph->user_count] = size;
+    
+    unsigned char *data = (unsigned char *)realloc(cg->data, size + 1);
+    if (data != NULL) {
+        cg->data = data;
+    }
+    cg->data_size = size;
+    
+    // Release the raw arrays; the compact form is now the only copy
+    for (int i = 0; i < graph->user_count; i++) {
+        free(graph->users[i].connections);
+        graph->users[i].connections = NULL;
+    }
+    graph->compressed = cg;
+    
+    long raw_bytes = (long)graph->user_count * MAX_CONNECTIONS * (long)sizeof(int);
+    long compact_bytes = (long)sizeof(CompressedGraph) +
+                         (long)(graph->user_count + 1) * (long)sizeof(int) + size;
+    
+    printf("Adjacency compacted for %d users (%d edge endpoints).\n",
+           graph->user_count, edge_count);
+    printf("Neighbor storage: %ld bytes raw -> %ld bytes compact", raw_bytes, compact_bytes);
+    if (raw_bytes > 0) {
+        printf(" (%.2fx smaller)", (float)raw_bytes / compact_bytes);
+    }
+    printf("\n");
+    
+    return true;
+}
+
+// Expand compact adjacency back into writable raw connection arrays
+bool expandAdjacency(Graph *graph) {
+    if (graph->compressed == NULL) {
+        return true;
+    }
+    
+    for (int i = 0; i < graph->user_count; i++) {
+        graph->users[i].connections = (int *)malloc(MAX_CONNECTIONS * sizeof(int));
+        
+        if (graph->users[i].connections == NULL) {
+            printf("Error: Out of memory.\n");
+            for (int j = 0; j < i; j++) {
+                free(graph->users[j].connections);
+                graph->users[j].connections = NULL;
+            }
+            return false;
+        }
+    }
+    
+    // Iterators still read the compact form until it is freed
+    for (int i = 0; i < graph->user_count; i++) {
+        NeighborIterator it;
+        int neighbor, j = 0;
+        
+        initNeighborIterator(graph, i, &it);
+        while (nextNeighbor(&it, &neighbor)) {
+            graph->users[i].connections[j++] = neighbor;
+        }
+    }
+    
+    freeCompressedGraph(graph);
+    return true;
+}
+
+// Insert a connection keeping the list sorted by ID
+void insertConnection(User *user, int friend_id) {
+    if (user->connection_count >= MAX_CONNECTIONS) {
+        return;
+    }
+    
+    int i = user->connection_count;
+    while (i > 0 && user->connections[i - 1] > friend_id) {
+        user->connections[i] = user->connections[i - 1];
+        i--;
+    }
+    
+    user->connections[i] = friend_id;
+    user->connection_count++;
 }
 
 // Add new user
@@ -281,13 +514,26 @@ int addUser(Graph *graph, char *name) {
         return -1; // Maximum user count reached
     }
     
+    // New users need writable connection arrays
+    if (!expandAdjacency(graph)) {
+        return -1;
+    }
+    
     int user_id = graph->user_count;
     
+    graph->users[user_id].connections = (int *)malloc(MAX_CONNECTIONS * sizeof(int));
+    if (graph->users[user_id].connections == NULL) {
+        printf("Error: Out of memory.\n");
+        return -1;
+    }
+    
     strcpy(graph->users[user_id].name, name);
     graph->users[user_id].id = user_id;
     graph->users[user_id].connection_count = 0;
     graph->users[user_id].influence_score = 0.0;
     graph->users[user_id].community_id = -1; // No community assigned initially
+    graph->users[user_id].coreness = -1; // Not computed yet
+    graph->coreness_valid = false;
     
     // Add to Red-Black Tree
     insertRB(graph, user_id);
@@ -304,20 +550,26 @@ bool createFriendship(Graph *graph, int user_id1, int user_id2) {
     }
     
     // Check if connection already exists
-    for (int i = 0; i < graph->users[user_id1].connection_count; i++) {
-        if (graph->users[user_id1].connections[i] == user_id2) {
+    NeighborIterator it;
+    int neighbor;
+    initNeighborIterator(graph, user_id1, &it);
+    while (nextNeighbor(&it, &neighbor)) {
+        if (neighbor == user_id2) {
             return true; // Connection already exists
         }
     }
     
-    // Add connection (both ways)
-    if (graph->users[user_id1].connection_count < MAX_CONNECTIONS) {
-        graph->users[user_id1].connections[graph->users[user_id1].connection_count++] = user_id2;
+    // Compact storage is read-only
+    if (!expandAdjacency(graph)) {
+        return false;
     }
     
-    if (graph->users[user_id2].connection_count < MAX_CONNECTIONS) {
-        graph->users[user_id2].connections[graph->users[user_id2].connection_count++] = user_id1;
-    }
+    // Coreness values no longer match the graph
+    graph->coreness_valid = false;
+    
+    // Add connection (both ways)
+    insertConnection(&graph->users[user_id1], user_id2);
+    insertConnection(&graph->users[user_id2], user_id1);
     
     return true;
 }
@@ -353,9 +605,11 @@ void findFriendsAtDistance(Graph *graph, int start_user_id, int distance) {
         }
         
         // Check all connections of this user
-        for (int i = 0; i < graph->users[current].connection_count; i++) {
-            int neighbor = graph->users[current].connections[i];
-            
+        NeighborIterator it;
+        int neighbor;
+        initNeighborIterator(graph, current, &it);
+        
+        while (nextNeighbor(&it, &neighbor)) {
             if (!visited[neighbor]) {
                 visited[neighbor] = true;
                 distances[neighbor] = distances[current] + 1;
@@ -383,6 +637,146 @@ void findFriendsAtDistance(Graph *graph, int start_user_id, int distance) {
     free(visited);
 }
 
+// Find friends at a specific distance for many sources at once.
+// Runs a multi-source BFS over batches of up to 64 sources, using one bit per
+// source in the seen/frontier words so each adjacency scan serves the whole batch.
+// Prints, per source, the members at the requested distance and a histogram
+// of how many users were reached at each distance.
+void findFriendsAtDistanceBatch(Graph *graph, int *sources, int source_count, int distance) {
+    if (source_count <= 0 || distance < 0) {
+        printf("Invalid batch query!\n");
+        return;
+    }
+    
+    for (int i = 0; i < source_count; i++) {
+        if (sources[i] < 0 || sources[i] >= graph->user_count) {
+            printf("Invalid user ID!\n");
+            return;
+        }
+    }
+    
+    // Nobody is farther than user_count - 1 hops away
+    int levels = distance;
+    if (levels > graph->user_count - 1) {
+        levels = graph->user_count - 1;
+    }
+    
+    uint64_t *seen = (uint64_t *)malloc(graph->user_count * sizeof(uint64_t));
+    uint64_t *frontier = (uint64_t *)malloc(graph->user_count * sizeof(uint64_t));
+    uint64_t *next = (uint64_t *)malloc(graph->user_count * sizeof(uint64_t));
+    int *histogram = (int *)malloc((size_t)MSBFS_BATCH_SIZE * (levels + 1) * sizeof(int));
+    
+    if (seen == NULL || frontier == NULL || next == NULL || histogram == NULL) {
+        printf("Error: Out of memory.\n");
+        free(seen);
+        free(frontier);
+        free(next);
+        free(histogram);
+        return;
+    }
+    
+    for (int base = 0; base < source_count; base += MSBFS_BATCH_SIZE) {
+        int batch_size = source_count - base;
+        if (batch_size > MSBFS_BATCH_SIZE) {
+            batch_size = MSBFS_BATCH_SIZE;
+        }
+        
+        memset(seen, 0, graph->user_count * sizeof(uint64_t));
+        memset(frontier, 0, graph->user_count * sizeof(uint64_t));
+        memset(histogram, 0, (size_t)MSBFS_BATCH_SIZE * (levels + 1) * sizeof(int));
+        
+        for (int b = 0; b < batch_size; b++) {
+            uint64_t bit = (uint64_t)1 << b;
+            seen[sources[base + b]] |= bit;
+            frontier[sources[base + b]] |= bit;
+            histogram[b * (levels + 1)]++;
+        }
+        
+        // Expand all sources one level at a time
+        int last_level = 0; // Deepest level that reached anyone
+        for (int level = 1; level <= levels; level++) {
+            memset(next, 0, graph->user_count * sizeof(uint64_t));
+            bool expanded = false;
+            
+            for (int v = 0; v < graph->user_count; v++) {
+                if (frontier[v] == 0) {
+                    continue;
+                }
+                
+                NeighborIterator it;
+                int neighbor;
+                initNeighborIterator(graph, v, &it);
+                
+                while (nextNeighbor(&it, &neighbor)) {
+                    uint64_t reached = frontier[v] & ~seen[neighbor];
+                    
+                    if (reached != 0) {
+                        next[neighbor] |= reached;
+                        seen[neighbor] |= reached;
+                        expanded = true;
+                    }
+                }
+            }
+            
+            // Count newly reached users per source
+            for (int v = 0; v < graph->user_count; v++) {
+                uint64_t bits = next[v];
+                while (bits != 0) {
+                    int b = __builtin_ctzll(bits);
+                    histogram[b * (levels + 1) + level]++;
+                    bits &= bits - 1;
+                }
+            }
+            
+            uint64_t *temp = frontier;
+            frontier = next;
+            next = temp;
+            
+            if (!expanded) {
+                break; // Nothing left to reach; frontier is now empty
+            }
+            last_level = level;
+        }
+        
+        // Requested distance is unreachable for every source
+        if (levels < distance) {
+            memset(frontier, 0, graph->user_count * sizeof(uint64_t));
+        }
+        
+        // Frontier now holds, per source, the users exactly at the desired distance
+        for (int b = 0; b < batch_size; b++) {
+            int source = sources[base + b];
+            uint64_t bit = (uint64_t)1 << b;
+            
+            printf("Friends at distance %d from %s:\n", distance, graph->users[source].name);
+            bool found = false;
+            
+            for (int v = 0; v < graph->user_count; v++) {
+                if (frontier[v] & bit) {
+                    printf("- %s (ID: %d)\n", graph->users[v].name, v);
+                    found = true;
+                }
+            }
+            
+            if (!found) {
+                printf("No friends found at this distance.\n");
+            }
+            
+            // Stop at the first level where this source reached nobody
+            printf("Users reached per distance:");
+            for (int level = 0; level <= last_level && histogram[b * (levels + 1) + level] > 0; level++) {
+                printf(" %d:%d", level, histogram[b * (levels + 1) + level]);
+            }
+            printf("\n\n");
+        }
+    }
+    
+    free(seen);
+    free(frontier);
+    free(next);
+    free(histogram);
+}
+
 // Find common friends between two users
 void findCommonFriends(Graph *graph, int user_id1, int user_id2) {
     if (user_id1 < 0 || user_id1 >= graph->user_count ||
@@ -397,16 +791,24 @@ void findCommonFriends(Graph *graph, int user_id1, int user_id2) {
     
     int common_count = 0;
     
-    // Check if each friend is common
-    for (int i = 0; i < graph->users[user_id1].connection_count; i++) {
-        int friend1 = graph->users[user_id1].connections[i];
-        
-        for (int j = 0; j < graph->users[user_id2].connection_count; j++) {
-            if (friend1 == graph->users[user_id2].connections[j]) {
-                printf("- %s (ID: %d)\n", graph->users[friend1].name, friend1);
-                common_count++;
-                break;
-            }
+    // Merge the two sorted friend lists
+    NeighborIterator it1, it2;
+    int friend1, friend2;
+    initNeighborIterator(graph, user_id1, &it1);
+    initNeighborIterator(graph, user_id2, &it2);
+    bool has1 = nextNeighbor(&it1, &friend1);
+    bool has2 = nextNeighbor(&it2, &friend2);
+    
+    while (has1 && has2) {
+        if (friend1 < friend2) {
+            has1 = nextNeighbor(&it1, &friend1);
+        } else if (friend1 > friend2) {
+            has2 = nextNeighbor(&it2, &friend2);
+        } else {
+            printf("- %s (ID: %d)\n", graph->users[friend1].name, friend1);
+            common_count++;
+            has1 = nextNeighbor(&it1, &friend1);
+            has2 = nextNeighbor(&it2, &friend2);
         }
     }
     
@@ -417,20 +819,555 @@ void findCommonFriends(Graph *graph, int user_id1, int user_id2) {
     }
 }
 
+// Recommendation scratch functions
+void initRecommendationScratch(RecommendationScratch *scratch) {
+    for (int i = 0; i < MAX_USERS; i++) {
+        scratch->score[i] = 0.0f;
+    }
+    scratch->touched_count = 0;
+}
+
+// Reset only the entries touched by the last query
+void resetRecommendationScratch(RecommendationScratch *scratch) {
+    for (int i = 0; i < scratch->touched_count; i++) {
+        scratch->score[scratch->touched[i]] = 0.0f;
+    }
+    scratch->touched_count = 0;
+}
+
+// True if a should rank below b (lower score, then higher ID)
+bool recommendationLess(Recommendation a, Recommendation b) {
+    if (a.score != b.score) {
+        return a.score < b.score;
+    }
+    return a.user_id > b.user_id;
+}
+
+// Min-heap sift down on the bounded top-k heap
+void siftDownRecommendations(Recommendation *heap, int size, int i) {
+    while (1) {
+        int smallest = i;
+        int left = 2 * i + 1;
+        int right = 2 * i + 2;
+        
+        if (left < size && recommendationLess(heap[left], heap[smallest])) {
+            smallest = left;
+        }
+        if (right < size && recommendationLess(heap[right], heap[smallest])) {
+            smallest = right;
+        }
+        if (smallest == i) {
+            return;
+        }
+        
+        Recommendation temp = heap[i];
+        heap[i] = heap[smallest];
+        heap[smallest] = temp;
+        i = smallest;
+    }
+}
+
+// Min-heap sift up on the bounded top-k heap
+void siftUpRecommendations(Recommendation *heap, int i) {
+    while (i > 0) {
+        int parent = (i - 1) / 2;
+        if (!recommendationLess(heap[i], heap[parent])) {
+            return;
+        }
+        
+        Recommendation temp = heap[i];
+        heap[i] = heap[parent];
+        heap[parent] = temp;
+        i = parent;
+    }
+}
+
+// Compute top-k "people you may know" for a user by walking two hops.
+// Each candidate is scored by common friends, or by Adamic-Adar
+// (sum of 1 / log(degree) over common friends) when adamic_adar is set.
+// Results are written to out in descending score order; returns their count.
+int computeRecommendations(Graph *graph, int user_id, int k, bool adamic_adar,
+                           RecommendationScratch *scratch, Recommendation *out) {
+    if (user_id < 0 || user_id >= graph->user_count || k <= 0) {
+        return 0;
+    }
+    
+    NeighborIterator it, friend_it;
+    int friend_id, candidate;
+    
+    // Accumulate scores for friends-of-friends
+    initNeighborIterator(graph, user_id, &it);
+    while (nextNeighbor(&it, &friend_id)) {
+        float weight = 1.0f;
+        if (adamic_adar) {
+            // Degree is at least 2 here (user and the candidate), so log > 0
+            weight = 1.0f / logf((float)graph->users[friend_id].connection_count);
+        }
+        
+        initNeighborIterator(graph, friend_id, &friend_it);
+        while (nextNeighbor(&friend_it, &candidate)) {
+            if (candidate == user_id) {
+                continue;
+            }
+            
+            if (scratch->score[candidate] == 0.0f) {
+                scratch->touched[scratch->touched_count++] = candidate;
+            }
+            scratch->score[candidate] += weight;
+        }
+    }
+    
+    // Existing friends are not recommended
+    initNeighborIterator(graph, user_id, &it);
+    while (nextNeighbor(&it, &friend_id)) {
+        scratch->score[friend_id] = 0.0f;
+    }
+    
+    // Keep the best k candidates in a bounded min-heap
+    int heap_size = 0;
+    for (int i = 0; i < scratch->touched_count; i++) {
+        int candidate = scratch->touched[i];
+        Recommendation entry = { candidate, scratch->score[candidate] };
+        
+        if (entry.score <= 0.0f) {
+            continue;
+        }
+        
+        if (heap_size < k) {
+            out[heap_size] = entry;
+            siftUpRecommendations(out, heap_size);
+            heap_size++;
+        } else if (recommendationLess(out[0], entry)) {
+            out[0] = entry;
+            siftDownRecommendations(out, heap_size, 0);
+        }
+    }
+    
+    resetRecommendationScratch(scratch);
+    
+    // Heap sort into descending order
+    for (int size = heap_size; size > 1; size--) {
+        Recommendation temp = out[0];
+        out[0] = out[size - 1];
+        out[size - 1] = temp;
+        siftDownRecommendations(out, size - 1, 0);
+    }
+    
+    return heap_size;
+}
+
+// Print recommendation list for a single user
+void printRecommendations(Graph *graph, int user_id, Recommendation *recs, int count) {
+    printf("People %s may know:\n", graph->users[user_id].name);
+    
+    if (count == 0) {
+        printf("No recommendations found.\n");
+        return;
+    }
+    
+    for (int i = 0; i < count; i++) {
+        printf("%d. %s (ID: %d) - Score: %.2f\n",
+               i + 1, graph->users[recs[i].user_id].name, recs[i].user_id, recs[i].score);
+    }
+}
+
+// Recommend top-k friends for a single user (scratch is reused between calls)
+void recommendFriends(Graph *graph, RecommendationScratch *scratch, int user_id, int k, bool adamic_adar) {
+    if (user_id < 0 || user_id >= graph->user_count) {
+        printf("Invalid user ID!\n");
+        return;
+    }
+    
+    if (k <= 0) {
+        printf("Invalid recommendation count!\n");
+        return;
+    }
+    
+    // A user can have at most user_count - 1 candidates
+    if (k > graph->user_count - 1) {
+        k = graph->user_count - 1;
+    }
+    if (k == 0) {
+        k = 1;
+    }
+    
+    Recommendation *recs = (Recommendation *)malloc(k * sizeof(Recommendation));
+    if (recs == NULL) {
+        printf("Error: Out of memory.\n");
+        return;
+    }
+    
+    int count = computeRecommendations(graph, user_id, k, adamic_adar, scratch, recs);
+    printRecommendations(graph, user_id, recs, count);
+    
+    free(recs);
+}
+
+// Recommend top-k friends for every user (parallel when built with OpenMP)
+void recommendFriendsForAll(Graph *graph, int k, bool adamic_adar) {
+    if (k <= 0) {
+        printf("Invalid recommendation count!\n");
+        return;
+    }
+    
+    if (graph->user_count == 0) {
+        printf("No users in the network.\n");
+        return;
+    }
+    
+    // A user can have at most user_count - 1 candidates
+    if (k > graph->user_count - 1) {
+        k = graph->user_count - 1;
+    }
+    if (k == 0) {
+        k = 1;
+    }
+    
+    Recommendation *recs = (Recommendation *)malloc((size_t)graph->user_count * k * sizeof(Recommendation));
+    int *counts = (int *)malloc(graph->user_count * sizeof(int));
+    
+    if (recs == NULL || counts == NULL) {
+        printf("Error: Out of memory.\n");
+        free(recs);
+        free(counts);
+        return;
+    }
+    
+    bool out_of_memory = false;
+    
+#ifdef _OPENMP
+    #pragma omp parallel
+#endif
+    {
+        // One scratch accumulator per thread
+        RecommendationScratch *scratch = (RecommendationScratch *)malloc(sizeof(RecommendationScratch));
+        if (scratch == NULL) {
+#ifdef _OPENMP
+            #pragma omp atomic write
+#endif
+            out_of_memory = true;
+        } else {
+            initRecommendationScratch(scratch);
+        }
+        
+#ifdef _OPENMP
+        #pragma omp for schedule(dynamic, 16)
+#endif
+        for (int i = 0; i < graph->user_count; i++) {
+            counts[i] = scratch != NULL ?
+                        computeRecommendations(graph, i, k, adamic_adar, scratch, &recs[(size_t)i * k]) : 0;
+        }
+        
+        free(scratch);
+    }
+    
+    if (out_of_memory) {
+        printf("Error: Out of memory.\n");
+        free(recs);
+        free(counts);
+        return;
+    }
+    
+    for (int i = 0; i < graph->user_count; i++) {
+        printRecommendations(graph, i, &recs[(size_t)i * k], counts[i]);
+        printf("\n");
+    }
+    
+    free(recs);
+    free(counts);
+}
+
+// K-core decomposition - compute each user's coreness by peeling
+// minimum-degree users with a bucket queue (Batagelj-Zaversnik, O(n + m)).
+// Returns false if memory could not be allocated.
+bool computeCoreness(Graph *graph) {
+    int n = graph->user_count;
+    if (n == 0) {
+        graph->coreness_valid = true;
+        return true;
+    }
+    
+    int *degree = (int *)malloc(n * sizeof(int));
+    int *bin = (int *)calloc(MAX_CONNECTIONS + 1, sizeof(int));
+    int *order = (int *)malloc(n * sizeof(int));
+    int *position = (int *)malloc(n * sizeof(int));
+    
+    if (degree == NULL || bin == NULL || order == NULL || position == NULL) {
+        printf("Error: Out of memory.\n");
+        free(degree);
+        free(bin);
+        free(order);
+        free(position);
+        return false;
+    }
+    
+    // Count users per degree
+    for (int i = 0; i < n; i++) {
+        degree[i] = graph->users[i].connection_count;
+        bin[degree[i]]++;
+    }
+    
+    // Turn counts into bucket start positions
+    int start = 0;
+    for (int d = 0; d <= MAX_CONNECTIONS; d++) {
+        int count = bin[d];
+        bin[d] = start;
+        start += count;
+    }
+    
+    // Place users into buckets ordered by degree
+    for (int i = 0; i < n; i++) {
+        position[i] = bin[degree[i]];
+        order[position[i]] = i;
+        bin[degree[i]]++;
+    }
+    
+    for (int d = MAX_CONNECTIONS; d > 0; d--) {
+        bin[d] = bin[d - 1];
+    }
+    bin[0] = 0;
+    
+    // Peel users in increasing degree order
+    for (int i = 0; i < n; i++) {
+        int v = order[i];
+        graph->users[v].coreness = degree[v];
+        
+        NeighborIterator it;
+        int u;
+        initNeighborIterator(graph, v, &it);
+        
+        while (nextNeighbor(&it, &u)) {
+            if (degree[u] > degree[v]) {
+                // Move u to the front of its bucket, then shrink its degree
+                int du = degree[u];
+                int pu = position[u];
+                int pw = bin[du];
+                int w = order[pw];
+                
+                if (u != w) {
+                    order[pu] = w;
+                    position[w] = pu;
+                    order[pw] = u;
+                    position[u] = pw;
+                }
+                
+                bin[du]++;
+                degree[u]--;
+            }
+        }
+    }
+    
+    free(degree);
+    free(bin);
+    free(order);
+    free(position);
+    
+    graph->coreness_valid = true;
+    return true;
+}
+
+// Parallel k-core decomposition - level-synchronous peeling where every
+// user whose remaining degree drops to k is removed in the same round
+// (parallel when built with OpenMP). Returns false if memory could not be allocated.
+bool computeCorenessParallel(Graph *graph) {
+    int n = graph->user_count;
+    if (n == 0) {
+        graph->coreness_valid = true;
+        return true;
+    }
+    
+    int *degree = (int *)malloc(n * sizeof(int));
+    bool *removed = (bool *)malloc(n * sizeof(bool));
+    int *frontier = (int *)malloc(n * sizeof(int));
+    int *next = (int *)malloc(n * sizeof(int));
+    
+    if (degree == NULL || removed == NULL || frontier == NULL || next == NULL) {
+        printf("Error: Out of memory.\n");
+        free(degree);
+        free(removed);
+        free(frontier);
+        free(next);
+        return false;
+    }
+    
+    for (int i = 0; i < n; i++) {
+        degree[i] = graph->users[i].connection_count;
+        removed[i] = false;
+    }
+    
+    int remaining = n;
+    
+    for (int k = 0; remaining > 0; k++) {
+        // Collect every user whose remaining degree is at most k
+        int frontier_size = 0;
+        for (int i = 0; i < n; i++) {
+            if (!removed[i] && degree[i] <= k) {
+                removed[i] = true;
+                graph->users[i].coreness = k;
+                frontier[frontier_size++] = i;
+            }
+        }
+        
+        // Peel the frontier until no neighbor drops to k
+        while (frontier_size > 0) {
+            remaining -= frontier_size;
+            int next_size = 0;
+            
+#ifdef _OPENMP
+            #pragma omp parallel for schedule(dynamic, 64)
+#endif
+            for (int f = 0; f < frontier_size; f++) {
+                NeighborIterator it;
+                int u;
+                initNeighborIterator(graph, frontier[f], &it);
+                
+                while (nextNeighbor(&it, &u)) {
+                    int old_degree;
+#ifdef _OPENMP
+                    #pragma omp atomic capture
+#endif
+                    old_degree = degree[u]--;
+                    
+                    // Exactly one decrement sees the drop from k + 1 to k.
+                    // Removed users are already at or below k and never match.
+                    if (old_degree == k + 1) {
+                        removed[u] = true;
+                        graph->users[u].coreness = k;
+                        
+                        int slot;
+#ifdef _OPENMP
+                        #pragma omp atomic capture
+#endif
+                        slot = next_size++;
+                        next[slot] = u;
+                    }
+                }
+            }
+            
+            int *temp = frontier;
+            frontier = next;
+            next = temp;
+            frontier_size = next_size;
+        }
+    }
+    
+    free(degree);
+    free(removed);
+    free(frontier);
+    free(next);
+    
+    graph->coreness_valid = true;
+    return true;
+}
+
+// Extract the maximum k-core: writes its members to out and returns their count
+int extractMaxCore(Graph *graph, int *out, int *max_core) {
+    *max_core = 0;
+    for (int i = 0; i < graph->user_count; i++) {
+        if (graph->users[i].coreness > *max_core) {
+            *max_core = graph->users[i].coreness;
+        }
+    }
+    
+    int count = 0;
+    for (int i = 0; i < graph->user_count; i++) {
+        if (graph->users[i].coreness == *max_core) {
+            out[count++] = i;
+        }
+    }
+    
+    return count;
+}
+
+// Analyze core/periphery structure - core-size distribution and maximum core
+void analyzeCores(Graph *graph, bool parallel) {
+    if (graph->user_count == 0) {
+        printf("No users in the network.\n");
+        return;
+    }
+    
+    bool computed = parallel ? computeCorenessParallel(graph) : computeCoreness(graph);
+    if (!computed) {
+        return;
+    }
+    
+    int *members = (int *)malloc(graph->user_count * sizeof(int));
+    if (members == NULL) {
+        printf("Error: Out of memory.\n");
+        return;
+    }
+    
+    int max_core;
+    int member_count = extractMaxCore(graph, members, &max_core);
+    
+    // Core-size distribution
+    int *core_sizes = (int *)calloc(max_core + 1, sizeof(int));
+    if (core_sizes == NULL) {
+        printf("Error: Out of memory.\n");
+        free(members);
+        return;
+    }
+    for (int i = 0; i < graph->user_count; i++) {
+        core_sizes[graph->users[i].coreness]++;
+    }
+    
+    printf("Core-size distribution:\n");
+    for (int k = 0; k <= max_core; k++) {
+        if (core_sizes[k] > 0) {
+            printf("Coreness %d: %d user(s)\n", k, core_sizes[k]);
+        }
+    }
+    
+    // Edges inside the maximum core subgraph
+    int edge_count = 0;
+    for (int i = 0; i < member_count; i++) {
+        NeighborIterator it;
+        int neighbor;
+        initNeighborIterator(graph, members[i], &it);
+        
+        while (nextNeighbor(&it, &neighbor)) {
+            if (graph->users[neighbor].coreness == max_core) {
+                edge_count++;
+            }
+        }
+    }
+    
+    printf("\nMaximum core (k = %d, %d members, %d connections):\n",
+           max_core, member_count, edge_count / 2);
+    for (int i = 0; i < member_count; i++) {
+        printf("- %s (ID: %d)\n", graph->users[members[i]].name, members[i]);
+    }
+    
+    free(members);
+    free(core_sizes);
+}
+
 // Calculate influence - determine how influential a user is
-void calculateInfluence(Graph *graph) {
+void calculateInfluence(Graph *graph, InfluenceMetric metric) {
     // Calculate a simple influence score for each user
-    // Initially based on connection count and second-degree connections
+    // Based on the user's metric value (connection count or coreness)
+    // plus the metric values of second-degree connections
+    
+    if (metric == INFLUENCE_CORENESS && !graph->coreness_valid) {
+        if (!computeCoreness(graph)) {
+            return;
+        }
+    }
     
     for (int i = 0; i < graph->user_count; i++) {
-        // Score for direct connections
-        float score = graph->users[i].connection_count;
+        // Score for the user itself
+        float score = metric == INFLUENCE_CORENESS ?
+                      graph->users[i].coreness : graph->users[i].connection_count;
         
         // Add score for second-degree connections with lower weight
         int second_degree = 0;
-        for (int j = 0; j < graph->users[i].connection_count; j++) {
-            int friend_id = graph->users[i].connections[j];
-            second_degree += graph->users[friend_id].connection_count;
+        NeighborIterator it;
+        int friend_id;
+        initNeighborIterator(graph, i, &it);
+        
+        while (nextNeighbor(&it, &friend_id)) {
+            second_degree += metric == INFLUENCE_CORENESS ?
+                             graph->users[friend_id].coreness : graph->users[friend_id].connection_count;
         }
         
         score += (float)second_degree * 0.1; // Lower weight for second-degree connections
@@ -499,8 +1436,12 @@ void detectCommunities(Graph *graph) {
     
     // Apply union operation for all connections
     for (int i = 0; i < graph->user_count; i++) {
-        for (int j = 0; j < graph->users[i].connection_count; j++) {
-            unite(i, graph->users[i].connections[j]);
+        NeighborIterator it;
+        int neighbor;
+        initNeighborIterator(graph, i, &it);
+        
+        while (nextNeighbor(&it, &neighbor)) {
+            unite(i, neighbor);
         }
     }
     
@@ -556,13 +1497,21 @@ void printUserInfo(Graph *graph, int user_id) {
     printf("Number of Friends: %d\n", user->connection_count);
     printf("Influence Score: %.2f\n", user->influence_score);
     printf("Community ID: %d\n", user->community_id);
+    if (graph->coreness_valid) {
+        printf("Coreness: %d\n", user->coreness);
+    } else {
+        printf("Coreness: not computed\n");
+    }
     
     printf("Friends:\n");
     if (user->connection_count == 0) {
         printf("- No friends yet.\n");
     } else {
-        for (int i = 0; i < user->connection_count; i++) {
-            int friend_id = user->connections[i];
+        NeighborIterator it;
+        int friend_id;
+        initNeighborIterator(graph, user_id, &it);
+        
+        while (nextNeighbor(&it, &friend_id)) {
             printf("- %s (ID: %d)\n", graph->users[friend_id].name, friend_id);
         }
     }
@@ -579,6 +1528,11 @@ void freeRBNode(RBNode *node) {
 
 void freeGraph(Graph *graph) {
     freeRBNode(graph->rb_root);
+    freeCompressedGraph(graph);
+    
+    for (int i = 0; i < graph->user_count; i++) {
+        free(graph->users[i].connections);
+    }
 }
 
 // Print all users in the network
@@ -599,7 +1553,11 @@ void showMenu() {
     printf("4. Find common friends between users\n");
     printf("5. Calculate influence scores\n");
     printf("6. Detect communities\n");
-    printf("7. Exit\n");
+    printf("7. Recommend friends\n");
+    printf("8. Find friends at specific distance for multiple users\n");
+    printf("9. Compact adjacency storage (expanded again on the next change)\n");
+    printf("10. Analyze k-core decomposition\n");
+    printf("11. Exit\n");
     printf("Enter your choice: ");
 }
 
@@ -607,7 +1565,10 @@ void showMenu() {
 int main() {
     Graph graph;
     initGraph(&graph);
-    int choice, user_id1, user_id2, distance;
+    RecommendationScratch recommendation_scratch;
+    initRecommendationScratch(&recommendation_scratch);
+    int choice, user_id1, user_id2, distance, k, mode, source_count;
+    int sources[MAX_USERS];
     char name[MAX_NAME_LENGTH];
     
     printf("===== Social Network Analysis Program =====\n\n");
@@ -728,14 +1689,108 @@ int main() {
                 break;
                 
             case 5: // Calculate influence
-                calculateInfluence(&graph);
+                printf("Influence metric (1 for connection count, 2 for coreness): ");
+                scanf("%d", &mode);
+                getchar(); // Clear input buffer
+                
+                calculateInfluence(&graph, mode == 2 ? INFLUENCE_CORENESS : INFLUENCE_DEGREE);
                 break;
                 
             case 6: // Detect communities
                 detectCommunities(&graph);
                 break;
                 
-            case 7: // Exit
+            case 7: // Recommend friends
+                printf("Recommend for (1) a single user or (2) all users: ");
+                scanf("%d", &mode);
+                getchar(); // Clear input buffer
+                
+                user_id1 = -1;
+                if (mode != 2) {
+                    printAllUsers(&graph);
+                    printf("Enter user ID or name: ");
+                    fgets(name, MAX_NAME_LENGTH, stdin);
+                    name[strcspn(name, "\n")] = 0;
+                    
+                    if (atoi(name) != 0 || name[0] == '0') {
+                        user_id1 = atoi(name);
+                    } else {
+                        user_id1 = findUserByName(&graph, name);
+                        if (user_id1 == -1) {
+                            printf("Error: User '%s' not found.\n", name);
+                            break;
+                        }
+                    }
+                }
+                
+                bool all_users = mode == 2;
+                
+                printf("Enter number of recommendations: ");
+                scanf("%d", &k);
+                printf("Scoring (1 for common friends, 2 for Adamic-Adar): ");
+                scanf("%d", &mode);
+                getchar(); // Clear input buffer
+                
+                if (all_users) {
+                    recommendFriendsForAll(&graph, k, mode == 2);
+                } else {
+                    recommendFriends(&graph, &recommendation_scratch, user_id1, k, mode == 2);
+                }
+                break;
+                
+            case 8: // Find friends at distance for multiple users
+                printAllUsers(&graph);
+                printf("Enter number of starting users: ");
+                scanf("%d", &source_count);
+                getchar(); // Clear input buffer
+                
+                if (source_count <= 0 || source_count > MAX_USERS) {
+                    printf("Error: Invalid number of users.\n");
+                    break;
+                }
+                
+                bool sources_valid = true;
+                for (int i = 0; i < source_count; i++) {
+                    printf("Enter starting user %d ID or name: ", i + 1);
+                    fgets(name, MAX_NAME_LENGTH, stdin);
+                    name[strcspn(name, "\n")] = 0;
+                    
+                    if (atoi(name) != 0 || name[0] == '0') {
+                        sources[i] = atoi(name);
+                    } else {
+                        sources[i] = findUserByName(&graph, name);
+                        if (sources[i] == -1) {
+                            printf("Error: User '%s' not found.\n", name);
+                            sources_valid = false;
+                            break;
+                        }
+                    }
+                }
+                
+                if (!sources_valid) {
+                    break;
+                }
+                
+                printf("Enter distance (1 for direct friends, 2 for friends of friends, etc.): ");
+                scanf("%d", &distance);
+                getchar(); // Clear input buffer
+                
+                findFriendsAtDistanceBatch(&graph, sources, source_count, distance);
+                break;
+                
+            case 9: // Compact adjacency storage
+                compactAdjacency(&graph);
+                break;
+                
+            case 10: // Analyze k-core decomposition
+                printf("Algorithm (1 for sequential, 2 for parallel): ");
+                scanf("%d", &mode);
+                getchar(); // Clear input buffer
+                
+                analyzeCores(&graph, mode == 2);
+                break;
+                
+            case 11: // Exit
                 printf("Exiting program. Goodbye!\n");
                 freeGraph(&graph);
                 return 0;